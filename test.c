@@ -8,6 +8,9 @@
 #include <wchar.h>
 #include <locale.h>
 #include <math.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
 
 // Modern color palette
 #define BG_DARK ((Color){15, 23, 42, 255})           // Slate-900
@@ -21,6 +24,13 @@
 #define ERROR_COLOR ((Color){239, 68, 68, 255})      // Red-500
 #define WARNING_COLOR ((Color){251, 191, 36, 255})   // Amber-400
 
+// City rotation settings
+#define ROTATION_PREFETCH_DEPTH 3       // Cities prepared ahead of the one on screen
+#define ROTATION_DEFAULT_INTERVAL 15.0f // Seconds each city stays on screen
+#define ROTATION_RETRY_MIN_DELAY 2      // Seconds the worker waits after a failed fetch
+#define ROTATION_RETRY_MAX_DELAY 60     // Cap for the doubling retry delay
+#define MAX_CACHED_ASSETS 16            // Must cover every banner and logo (12 today)
+
 // Application state enum for error handling
 typedef enum {
   STATE_LOADING,
@@ -28,7 +38,8 @@ typedef enum {
   STATE_ERROR_API_KEY,
   STATE_ERROR_NETWORK,
   STATE_ERROR_INVALID_CITY,
-  STATE_ERROR_JSON_PARSE
+  STATE_ERROR_JSON_PARSE,
+  STATE_ERROR_USAGE
 } AppState;
 
 struct Memory
@@ -51,8 +62,33 @@ typedef struct weatherData
   char description[256];  // Weather description
   int feelsLike;          // Feels like temperature
   int windSpeed;          // Wind speed
+  char bannerPath[512];   // Resolved banner asset path
+  char logoPath[512];     // Resolved logo asset path
 } weatherData;
 
+// Displayed fields of a weather record, used to track what changed on refresh
+typedef enum {
+  FIELD_LOCATION,
+  FIELD_DESCRIPTION,
+  FIELD_TEMPERATURE,
+  FIELD_FEELS_LIKE,
+  FIELD_HUMIDITY,
+  FIELD_WIND_SPEED,
+  FIELD_ASSETS,
+  FIELD_COUNT
+} WeatherField;
+
+#define FIELD_BIT(field) (1u << (field))
+#define ALL_FIELDS_CHANGED (FIELD_BIT(FIELD_COUNT) - 1)
+
+// Formatted strings and measurements reused across frames
+typedef struct {
+  char location[256];
+  char feelsLike[32];
+  char windSpeed[32];
+  Vector2 temperatureSize;
+} TextCache;
+
 // Animation state
 typedef struct {
   float cardScale;
@@ -61,8 +97,52 @@ typedef struct {
   float logoFloat;
   float fadeIn;
   float shimmerOffset;
+  float fieldFade[FIELD_COUNT]; // Per-field fade for values changed by a refresh
+  float crossFade;              // Progress of the city rotation cross-fade
 } AnimationState;
 
+// Stage of a prefetch slot in the city rotation pipeline
+typedef enum {
+  SLOT_EMPTY,
+  SLOT_LOADING,
+  SLOT_READY
+} SlotStage;
+
+// One city prepared ahead of time by the rotation worker
+typedef struct {
+  SlotStage stage;
+  AppState state;
+  char city[100];
+  weatherData data;
+  Image bannerImage;  // Decoded off the render thread, uploaded before the swap
+  Image logoImage;
+} RotationSlot;
+
+// Prefetch pipeline that keeps several cities ready for instant transitions
+typedef struct {
+  char **cities;
+  int cityCount;
+  int nextCity;       // Worker only
+  const char *apiKey;
+  const char *basePath;
+  RotationSlot slots[ROTATION_PREFETCH_DEPTH];
+  int writeIndex;     // Worker only
+  int readIndex;      // Render thread only
+  char decodedPaths[MAX_CACHED_ASSETS][512]; // Guarded by lock
+  int decodedCount;
+  bool running;
+  pthread_mutex_t lock;
+  pthread_cond_t slotFreed;
+  pthread_t worker;
+} RotationPipeline;
+
+// GPU textures keyed by asset path, owned by the render thread
+typedef struct {
+  char paths[MAX_CACHED_ASSETS][512];
+  Texture2D textures[MAX_CACHED_ASSETS];
+  int count;
+} TextureCache;
+
 size_t callback_func(void *ptr, size_t size, size_t num_of_members, void *userData)
 {
   size_t total = size * num_of_members;
@@ -182,191 +262,632 @@ void DrawCard(Rectangle bounds, float roundness, Color color, float shadowIntens
   DrawRectangleRoundedLines(bounds, roundness, 16, Fade(WHITE, 0.1f));
 }
 
-// Function to fetch weather data for a given city
-AppState fetchWeatherData(const char *city, const char *API_KEY, weatherData *myData, 
-                          const char **fullPath_of_WeatherBanner, const char **fullPath_of_WeatherLogo,
-                          const char *basePath) {
-  AppState appState = STATE_LOADING;
-  char url[256] = {0};
-  snprintf(url, sizeof(url), "https://api.openweathermap.org/data/2.5/weather?q=%s&appid=%s", city, API_KEY);
+// Function to download the raw weather response for a given city; abortCheck may cancel the transfer
+AppState downloadWeatherJson(const char *city, const char *API_KEY, struct Memory *chunk, weatherData *myData,
+                             curl_xferinfo_callback abortCheck, void *abortData) {
+  AppState appState = STATE_SUCCESS;
+  char url[512] = {0};
 
-  struct Memory chunk = {0};
-  chunk.data = malloc(1);
-  if (chunk.data == NULL) {
+  chunk->data = malloc(1);
+  if (chunk->data == NULL) {
     fprintf(stderr, "malloc failed to allocate data for the chunk");
     snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
              "Memory Error\nFailed to allocate memory");
     return STATE_ERROR_NETWORK;
   }
-  chunk.size = 0;
-  cJSON *json = NULL;
+  chunk->size = 0;
+
+  CURL *curl = curl_easy_init();
+  if (curl == NULL) {
+    snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
+             "Network Error\nFailed to initialize CURL");
+    return STATE_ERROR_NETWORK;
+  }
+
+  // Escape the city so names like "New York" form a valid URL
+  char *escapedCity = curl_easy_escape(curl, city, 0);
+  if (escapedCity == NULL) {
+    snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
+             "Memory Error\nFailed to encode city name");
+    curl_easy_cleanup(curl);
+    return STATE_ERROR_NETWORK;
+  }
+  snprintf(url, sizeof(url), "https://api.openweathermap.org/data/2.5/weather?q=%s&appid=%s", escapedCity, API_KEY);
+  curl_free(escapedCity);
 
-  CURL *curl;
-  CURLcode result = curl_global_init(CURL_GLOBAL_ALL);
+  curl_easy_setopt(curl, CURLOPT_URL, url);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, callback_func);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, chunk);
+  curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
+  curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L); // Required for timeouts on worker threads
+  if (abortCheck != NULL) {
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, abortCheck);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, abortData);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+  }
+  CURLcode result = curl_easy_perform(curl);
 
   if (result != CURLE_OK) {
     appState = STATE_ERROR_NETWORK;
     snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
-             "Network Error\nFailed to initialize CURL");
-    free(chunk.data);
-    return appState;
+             "Network Error\n%s", curl_easy_strerror(result));
   }
-  
-  curl = curl_easy_init();
-  if (curl) {
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, callback_func);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &chunk);
-    result = curl_easy_perform(curl);
+  curl_easy_cleanup(curl);
+  return appState;
+}
 
-    if (result != CURLE_OK) {
-      appState = STATE_ERROR_NETWORK;
-      snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
-               "Network Error\n%s", curl_easy_strerror(result));
-    } else {
-      json = cJSON_Parse(chunk.data);
-      if (json != NULL) {
-        // Check if API returned an error (e.g., city not found)
-        cJSON *cod = cJSON_GetObjectItemCaseSensitive(json, "cod");
-        if (cJSON_IsNumber(cod) && cod->valueint == 404) {
-          appState = STATE_ERROR_INVALID_CITY;
-          snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
-                   "City Not Found\nPlease check the city name");
-        } else if (cJSON_IsString(cod) && strcmp(cod->valuestring, "404") == 0) {
-          appState = STATE_ERROR_INVALID_CITY;
-          snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
-                   "City Not Found\nPlease check the city name");
-        } else {
-          // Parse all weather data
-          cJSON *location = cJSON_GetObjectItemCaseSensitive(json, "name");
-          if (cJSON_IsString(location) && strlen(location->valuestring) < sizeof(myData->city)) {
-            strcpy(myData->city, location->valuestring);
-          }
-          
-          cJSON *sys = cJSON_GetObjectItemCaseSensitive(json, "sys");
-          if (cJSON_IsObject(sys)) {
-            cJSON *country = cJSON_GetObjectItemCaseSensitive(sys, "country");
-            if (cJSON_IsString(country) && strlen(country->valuestring) < sizeof(myData->country)) {
-              strcpy(myData->country, country->valuestring);
-            }
-          }
-          
-          cJSON *weather_obj = cJSON_GetObjectItemCaseSensitive(json, "weather");
-          cJSON *firstITEM = cJSON_GetArrayItem(weather_obj, 0);
-          cJSON *weather_name = cJSON_GetObjectItemCaseSensitive(firstITEM, "main");
-          if (cJSON_IsString(weather_name) && strlen(weather_name->valuestring) < sizeof(myData->weatherName)) {
-            strcpy(myData->weatherName, weather_name->valuestring);
-          }
-          
-          // Get weather description
-          cJSON *weather_desc = cJSON_GetObjectItemCaseSensitive(firstITEM, "description");
-          if (cJSON_IsString(weather_desc) && strlen(weather_desc->valuestring) < sizeof(myData->description)) {
-            strcpy(myData->description, weather_desc->valuestring);
-            // Capitalize first letter
-            if (myData->description[0] >= 'a' && myData->description[0] <= 'z') {
-              myData->description[0] = myData->description[0] - 32;
-            }
-          }
-          
-          cJSON *temperature_obj = cJSON_GetObjectItemCaseSensitive(json, "main");
-          cJSON *temperature = cJSON_GetObjectItemCaseSensitive(temperature_obj, "temp");
-          if (cJSON_IsNumber(temperature)) {
-            snprintf(myData->temperature, sizeof(myData->temperature), "%d°C", (int)(temperature->valuedouble - 273.15));
-          }
-          
-          // Get feels like temperature
-          cJSON *feels_like = cJSON_GetObjectItemCaseSensitive(temperature_obj, "feels_like");
-          if (cJSON_IsNumber(feels_like)) {
-            myData->feelsLike = (int)(feels_like->valuedouble - 273.15);
-          }
-          
-          cJSON *humidity = cJSON_GetObjectItemCaseSensitive(temperature_obj, "humidity");
-          if (cJSON_IsNumber(humidity)) {
-            snprintf(myData->humidity, sizeof(myData->humidity), "%d%%", (int)(humidity->valuedouble));
-          }
-          
-          // Get wind speed
-          cJSON *wind_obj = cJSON_GetObjectItemCaseSensitive(json, "wind");
-          if (cJSON_IsObject(wind_obj)) {
-            cJSON *wind_speed = cJSON_GetObjectItemCaseSensitive(wind_obj, "speed");
-            if (cJSON_IsNumber(wind_speed)) {
-              myData->windSpeed = (int)(wind_speed->valuedouble * 3.6); // Convert m/s to km/h
-            }
-          }
-          
-          cJSON *weatherID = cJSON_GetObjectItemCaseSensitive(firstITEM, "id");
-          if (cJSON_IsNumber(weatherID)) {
-            myData->weatherID = weatherID->valuedouble;
-          }
+// Function to parse a weather response into myData
+AppState parseWeatherJson(const char *body, weatherData *myData) {
+  AppState appState = STATE_SUCCESS;
+  cJSON *json = cJSON_Parse(body);
+  if (json == NULL) {
+    snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
+             "Parse Error\nFailed to parse API response");
+    return STATE_ERROR_JSON_PARSE;
+  }
 
-          // Determining weather banner and logo
-          if (myData->weatherID >= 200 && myData->weatherID <= 232) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/thunderStorm.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/thunderStorm.png", basePath);
-          } else if (myData->weatherID >= 300 && myData->weatherID <= 321) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/rain.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/rain.png", basePath);
-          } else if (myData->weatherID >= 500 && myData->weatherID <= 531) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/rain.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/rain.png", basePath);
-          } else if (myData->weatherID >= 600 && myData->weatherID <= 622) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/snow.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/snow.png", basePath);
-          } else if (myData->weatherID >= 701 && myData->weatherID <= 781) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/fog.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/fog.png", basePath);
-          } else if (myData->weatherID == 800) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/clear.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/sunny.png", basePath);
-          } else if (myData->weatherID > 800 && myData->weatherID <= 804) {
-            *fullPath_of_WeatherBanner = TextFormat("%sassets/weatherBanner/clouds.jpg", basePath);
-            *fullPath_of_WeatherLogo = TextFormat("%sassets/weatherLogos/clouds.png", basePath);
-          }
-          
-          appState = STATE_SUCCESS;
-        }
-        cJSON_Delete(json);
-      } else {
-        appState = STATE_ERROR_JSON_PARSE;
-        snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
-                 "Parse Error\nFailed to parse API response");
+  // Check if API returned an error (e.g., city not found)
+  cJSON *cod = cJSON_GetObjectItemCaseSensitive(json, "cod");
+  if (cJSON_IsNumber(cod) && cod->valueint == 404) {
+    appState = STATE_ERROR_INVALID_CITY;
+    snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
+             "City Not Found\nPlease check the city name");
+  } else if (cJSON_IsString(cod) && strcmp(cod->valuestring, "404") == 0) {
+    appState = STATE_ERROR_INVALID_CITY;
+    snprintf(myData->errorMessage, sizeof(myData->errorMessage), 
+             "City Not Found\nPlease check the city name");
+  } else {
+    // Parse all weather data
+    cJSON *location = cJSON_GetObjectItemCaseSensitive(json, "name");
+    if (cJSON_IsString(location) && strlen(location->valuestring) < sizeof(myData->city)) {
+      strcpy(myData->city, location->valuestring);
+    }
+    
+    cJSON *sys = cJSON_GetObjectItemCaseSensitive(json, "sys");
+    if (cJSON_IsObject(sys)) {
+      cJSON *country = cJSON_GetObjectItemCaseSensitive(sys, "country");
+      if (cJSON_IsString(country) && strlen(country->valuestring) < sizeof(myData->country)) {
+        strcpy(myData->country, country->valuestring);
       }
     }
-    curl_easy_cleanup(curl);
+    
+    cJSON *weather_obj = cJSON_GetObjectItemCaseSensitive(json, "weather");
+    cJSON *firstITEM = cJSON_GetArrayItem(weather_obj, 0);
+    cJSON *weather_name = cJSON_GetObjectItemCaseSensitive(firstITEM, "main");
+    if (cJSON_IsString(weather_name) && strlen(weather_name->valuestring) < sizeof(myData->weatherName)) {
+      strcpy(myData->weatherName, weather_name->valuestring);
+    }
+    
+    // Get weather description
+    cJSON *weather_desc = cJSON_GetObjectItemCaseSensitive(firstITEM, "description");
+    if (cJSON_IsString(weather_desc) && strlen(weather_desc->valuestring) < sizeof(myData->description)) {
+      strcpy(myData->description, weather_desc->valuestring);
+      // Capitalize first letter
+      if (myData->description[0] >= 'a' && myData->description[0] <= 'z') {
+        myData->description[0] = myData->description[0] - 32;
+      }
+    }
+    
+    cJSON *temperature_obj = cJSON_GetObjectItemCaseSensitive(json, "main");
+    cJSON *temperature = cJSON_GetObjectItemCaseSensitive(temperature_obj, "temp");
+    if (cJSON_IsNumber(temperature)) {
+      snprintf(myData->temperature, sizeof(myData->temperature), "%d°C", (int)(temperature->valuedouble - 273.15));
+    }
+    
+    // Get feels like temperature
+    cJSON *feels_like = cJSON_GetObjectItemCaseSensitive(temperature_obj, "feels_like");
+    if (cJSON_IsNumber(feels_like)) {
+      myData->feelsLike = (int)(feels_like->valuedouble - 273.15);
+    }
+    
+    cJSON *humidity = cJSON_GetObjectItemCaseSensitive(temperature_obj, "humidity");
+    if (cJSON_IsNumber(humidity)) {
+      snprintf(myData->humidity, sizeof(myData->humidity), "%d%%", (int)(humidity->valuedouble));
+    }
+    
+    // Get wind speed
+    cJSON *wind_obj = cJSON_GetObjectItemCaseSensitive(json, "wind");
+    if (cJSON_IsObject(wind_obj)) {
+      cJSON *wind_speed = cJSON_GetObjectItemCaseSensitive(wind_obj, "speed");
+      if (cJSON_IsNumber(wind_speed)) {
+        myData->windSpeed = (int)(wind_speed->valuedouble * 3.6); // Convert m/s to km/h
+      }
+    }
+    
+    cJSON *weatherID = cJSON_GetObjectItemCaseSensitive(firstITEM, "id");
+    if (cJSON_IsNumber(weatherID)) {
+      myData->weatherID = weatherID->valuedouble;
+    }
+  }
+
+  cJSON_Delete(json);
+  return appState;
+}
+
+// Function to determine the weather banner and logo for the parsed weather ID
+void resolveWeatherAssets(weatherData *myData, const char *basePath) {
+  if (myData->weatherID >= 200 && myData->weatherID <= 232) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/thunderStorm.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/thunderStorm.png", basePath);
+  } else if (myData->weatherID >= 300 && myData->weatherID <= 321) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/rain.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/rain.png", basePath);
+  } else if (myData->weatherID >= 500 && myData->weatherID <= 531) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/rain.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/rain.png", basePath);
+  } else if (myData->weatherID >= 600 && myData->weatherID <= 622) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/snow.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/snow.png", basePath);
+  } else if (myData->weatherID >= 701 && myData->weatherID <= 781) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/fog.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/fog.png", basePath);
+  } else if (myData->weatherID == 800) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/clear.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/sunny.png", basePath);
+  } else if (myData->weatherID > 800 && myData->weatherID <= 804) {
+    snprintf(myData->bannerPath, sizeof(myData->bannerPath), "%sassets/weatherBanner/clouds.jpg", basePath);
+    snprintf(myData->logoPath, sizeof(myData->logoPath), "%sassets/weatherLogos/clouds.png", basePath);
+  }
+}
+
+// Function to fetch weather data for a given city
+AppState fetchWeatherData(const char *city, const char *API_KEY, weatherData *myData, const char *basePath) {
+  struct Memory chunk = {0};
+  AppState appState = downloadWeatherJson(city, API_KEY, &chunk, myData, NULL, NULL);
+  if (appState == STATE_SUCCESS) {
+    appState = parseWeatherJson(chunk.data, myData);
+  }
+  if (appState == STATE_SUCCESS) {
+    resolveWeatherAssets(myData, basePath);
   }
-  
   free(chunk.data);
-  curl_global_cleanup();
   return appState;
 }
 
+// Function to compare two weather records field by field
+unsigned int diffWeatherData(const weatherData *oldData, const weatherData *newData) {
+  unsigned int changed = 0;
+
+  if (strcmp(oldData->city, newData->city) != 0 || strcmp(oldData->country, newData->country) != 0) {
+    changed |= FIELD_BIT(FIELD_LOCATION);
+  }
+  if (strcmp(oldData->description, newData->description) != 0) {
+    changed |= FIELD_BIT(FIELD_DESCRIPTION);
+  }
+  if (strcmp(oldData->temperature, newData->temperature) != 0) {
+    changed |= FIELD_BIT(FIELD_TEMPERATURE);
+  }
+  if (oldData->feelsLike != newData->feelsLike) {
+    changed |= FIELD_BIT(FIELD_FEELS_LIKE);
+  }
+  if (strcmp(oldData->humidity, newData->humidity) != 0) {
+    changed |= FIELD_BIT(FIELD_HUMIDITY);
+  }
+  if (oldData->windSpeed != newData->windSpeed) {
+    changed |= FIELD_BIT(FIELD_WIND_SPEED);
+  }
+  if (strcmp(oldData->bannerPath, newData->bannerPath) != 0 || strcmp(oldData->logoPath, newData->logoPath) != 0) {
+    changed |= FIELD_BIT(FIELD_ASSETS);
+  }
+
+  return changed;
+}
+
+// Function to load a weather texture, reusing the current one if its asset path is unchanged
+Texture2D updateWeatherTexture(Texture2D current, const char *currentPath, const char *newPath, const char *name) {
+  if (current.id != 0 && strcmp(currentPath, newPath) == 0) {
+    return current;
+  }
+  if (current.id != 0) UnloadTexture(current);
+
+  if (newPath[0] == '\0') {
+    fprintf(stderr, "Failed to load path for weather %s\n", name);
+    return (Texture2D){0};
+  }
+
+  Texture2D texture = LoadTexture(newPath);
+  if (texture.id == 0) {
+    fprintf(stderr, "unable to load weather %s texture\n", name);
+  }
+  return texture;
+}
+
+// Function to rebuild only the cached strings and measurements affected by a change
+void updateTextCache(TextCache *cache, const weatherData *data, unsigned int changed, Font tempFont) {
+  if (changed & FIELD_BIT(FIELD_LOCATION)) {
+    snprintf(cache->location, sizeof(cache->location), "%s, %s", data->city, data->country);
+  }
+  if (changed & FIELD_BIT(FIELD_TEMPERATURE)) {
+    cache->temperatureSize = MeasureTextEx(tempFont, data->temperature, 96, 3);
+  }
+  if (changed & FIELD_BIT(FIELD_FEELS_LIKE)) {
+    snprintf(cache->feelsLike, sizeof(cache->feelsLike), "%d°C", data->feelsLike);
+  }
+  if (changed & FIELD_BIT(FIELD_WIND_SPEED)) {
+    snprintf(cache->windSpeed, sizeof(cache->windSpeed), "%d km/h", data->windSpeed);
+  }
+}
+
+// Function to decode an asset image once, skipping paths already handed to the render thread
+Image decodeRotationAsset(RotationPipeline *pipeline, const char *path) {
+  if (path[0] == '\0') return (Image){0};
+
+  bool decoded = false;
+  pthread_mutex_lock(&pipeline->lock);
+  for (int i = 0; i < pipeline->decodedCount; i++) {
+    if (strcmp(pipeline->decodedPaths[i], path) == 0) decoded = true;
+  }
+  pthread_mutex_unlock(&pipeline->lock);
+  if (decoded) return (Image){0};
+
+  Image image = LoadImage(path);
+  if (image.data == NULL) {
+    // Not recorded, so the next city using this asset tries again
+    fprintf(stderr, "unable to decode weather asset %s\n", path);
+    return image;
+  }
+
+  pthread_mutex_lock(&pipeline->lock);
+  if (pipeline->decodedCount < MAX_CACHED_ASSETS) {
+    snprintf(pipeline->decodedPaths[pipeline->decodedCount], sizeof(pipeline->decodedPaths[0]), "%s", path);
+    pipeline->decodedCount++;
+  }
+  pthread_mutex_unlock(&pipeline->lock);
+  return image;
+}
+
+// Function to make the worker decode an asset again after its upload failed
+void forgetRotationAsset(RotationPipeline *pipeline, const char *path) {
+  pthread_mutex_lock(&pipeline->lock);
+  for (int i = 0; i < pipeline->decodedCount; i++) {
+    if (strcmp(pipeline->decodedPaths[i], path) == 0) {
+      pipeline->decodedCount--;
+      memcpy(pipeline->decodedPaths[i], pipeline->decodedPaths[pipeline->decodedCount], sizeof(pipeline->decodedPaths[0]));
+      break;
+    }
+  }
+  pthread_mutex_unlock(&pipeline->lock);
+}
+
+// Transfer callback that aborts a rotation download once the pipeline is stopping
+int rotationTransferProgress(void *clientp, curl_off_t dltotal, curl_off_t dlnow,
+                             curl_off_t ultotal, curl_off_t ulnow) {
+  RotationPipeline *pipeline = (RotationPipeline *)clientp;
+  (void)dltotal; (void)dlnow; (void)ultotal; (void)ulnow;
+
+  pthread_mutex_lock(&pipeline->lock);
+  bool running = pipeline->running;
+  pthread_mutex_unlock(&pipeline->lock);
+  return running ? 0 : 1;
+}
+
+// Function to pause the worker after a failed fetch; returns early when the pipeline stops
+void waitForRotationRetry(RotationPipeline *pipeline, int seconds) {
+  struct timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += seconds;
+
+  while (pipeline->running) {
+    if (pthread_cond_timedwait(&pipeline->slotFreed, &pipeline->lock, &deadline) == ETIMEDOUT) break;
+  }
+}
+
+// Worker thread: fetch, parse and resolve assets for upcoming cities
+void *rotationWorker(void *arg) {
+  RotationPipeline *pipeline = (RotationPipeline *)arg;
+  int retryDelay = 0;
+
+  pthread_mutex_lock(&pipeline->lock);
+  while (pipeline->running) {
+    RotationSlot *slot = &pipeline->slots[pipeline->writeIndex];
+    if (slot->stage != SLOT_EMPTY) {
+      pthread_cond_wait(&pipeline->slotFreed, &pipeline->lock);
+      continue;
+    }
+    slot->stage = SLOT_LOADING;
+    pthread_mutex_unlock(&pipeline->lock);
+
+    const char *city = pipeline->cities[pipeline->nextCity];
+    pipeline->nextCity = (pipeline->nextCity + 1) % pipeline->cityCount;
+
+    memset(&slot->data, 0, sizeof(weatherData));
+    snprintf(slot->city, sizeof(slot->city), "%s", city);
+    slot->bannerImage = (Image){0};
+    slot->logoImage = (Image){0};
+
+    struct Memory chunk = {0};
+    AppState state = downloadWeatherJson(city, pipeline->apiKey, &chunk, &slot->data,
+                                         rotationTransferProgress, pipeline);
+    if (state == STATE_SUCCESS) {
+      state = parseWeatherJson(chunk.data, &slot->data);
+    }
+    free(chunk.data);
+    if (state == STATE_SUCCESS) {
+      resolveWeatherAssets(&slot->data, pipeline->basePath);
+      slot->bannerImage = decodeRotationAsset(pipeline, slot->data.bannerPath);
+      slot->logoImage = decodeRotationAsset(pipeline, slot->data.logoPath);
+    }
+    slot->state = state;
+
+    pthread_mutex_lock(&pipeline->lock);
+    slot->stage = SLOT_READY;
+    pipeline->writeIndex = (pipeline->writeIndex + 1) % ROTATION_PREFETCH_DEPTH;
+
+    // Back off after failures so a dead network or bad city list doesn't hammer the API;
+    // a download aborted by shutdown is not a failure
+    if (state == STATE_SUCCESS) {
+      retryDelay = 0;
+    } else if (pipeline->running) {
+      retryDelay = retryDelay == 0 ? ROTATION_RETRY_MIN_DELAY : retryDelay * 2;
+      if (retryDelay > ROTATION_RETRY_MAX_DELAY) retryDelay = ROTATION_RETRY_MAX_DELAY;
+      fprintf(stderr, "Skipping %s in rotation, next fetch in %d s\n", city, retryDelay);
+      waitForRotationRetry(pipeline, retryDelay);
+    }
+  }
+  pthread_mutex_unlock(&pipeline->lock);
+  return NULL;
+}
+
+// Function to start the rotation worker
+bool startRotationPipeline(RotationPipeline *pipeline, char **cities, int cityCount,
+                           const char *apiKey, const char *basePath) {
+  memset(pipeline, 0, sizeof(RotationPipeline));
+  pipeline->cities = cities;
+  pipeline->cityCount = cityCount;
+  pipeline->apiKey = apiKey;
+  pipeline->basePath = basePath;
+  pipeline->running = true;
+  pthread_mutex_init(&pipeline->lock, NULL);
+  pthread_cond_init(&pipeline->slotFreed, NULL);
+
+  if (pthread_create(&pipeline->worker, NULL, rotationWorker, pipeline) != 0) {
+    fprintf(stderr, "Failed to start the city rotation worker\n");
+    pipeline->running = false;
+    return false;
+  }
+  return true;
+}
+
+// Function to stop the rotation worker and free any images it left behind
+void stopRotationPipeline(RotationPipeline *pipeline) {
+  pthread_mutex_lock(&pipeline->lock);
+  pipeline->running = false;
+  pthread_cond_broadcast(&pipeline->slotFreed);
+  pthread_mutex_unlock(&pipeline->lock);
+  pthread_join(pipeline->worker, NULL);
+
+  for (int i = 0; i < ROTATION_PREFETCH_DEPTH; i++) {
+    if (pipeline->slots[i].bannerImage.data != NULL) UnloadImage(pipeline->slots[i].bannerImage);
+    if (pipeline->slots[i].logoImage.data != NULL) UnloadImage(pipeline->slots[i].logoImage);
+  }
+  pthread_mutex_destroy(&pipeline->lock);
+  pthread_cond_destroy(&pipeline->slotFreed);
+}
+
+// Function to return the next slot if the worker has finished it, or NULL
+RotationSlot *peekRotationSlot(RotationPipeline *pipeline) {
+  RotationSlot *slot = &pipeline->slots[pipeline->readIndex];
+  pthread_mutex_lock(&pipeline->lock);
+  bool ready = slot->stage == SLOT_READY;
+  pthread_mutex_unlock(&pipeline->lock);
+  return ready ? slot : NULL;
+}
+
+// Function to hand a consumed slot back to the worker
+void releaseRotationSlot(RotationPipeline *pipeline) {
+  pthread_mutex_lock(&pipeline->lock);
+  pipeline->slots[pipeline->readIndex].stage = SLOT_EMPTY;
+  pthread_cond_signal(&pipeline->slotFreed);
+  pthread_mutex_unlock(&pipeline->lock);
+  pipeline->readIndex = (pipeline->readIndex + 1) % ROTATION_PREFETCH_DEPTH;
+}
+
+// Function to look up an uploaded texture by asset path
+Texture2D findCachedTexture(const TextureCache *cache, const char *path) {
+  for (int i = 0; i < cache->count; i++) {
+    if (strcmp(cache->paths[i], path) == 0) return cache->textures[i];
+  }
+  return (Texture2D){0};
+}
+
+// Function to upload a decoded image into the texture cache; returns false if nothing was cached
+bool uploadCachedTexture(TextureCache *cache, const char *path, Image *image) {
+  bool cached = findCachedTexture(cache, path).id != 0;
+  if (!cached && cache->count >= MAX_CACHED_ASSETS) {
+    fprintf(stderr, "texture cache full, dropping weather texture %s\n", path);
+  } else if (!cached) {
+    Texture2D texture = LoadTextureFromImage(*image);
+    if (texture.id == 0) {
+      fprintf(stderr, "unable to upload weather texture %s\n", path);
+    } else {
+      snprintf(cache->paths[cache->count], sizeof(cache->paths[0]), "%s", path);
+      cache->textures[cache->count] = texture;
+      cache->count++;
+      cached = true;
+    }
+  }
+  UnloadImage(*image);
+  *image = (Image){0};
+  return cached;
+}
+
+// Function to draw the main weather card; alpha is used for cross-fading between cities
+void DrawWeatherCard(const weatherData *data, const TextCache *textCache, Rectangle mainCard,
+                     Font customFont, Font regularFont, const AnimationState *anim, float alpha) {
+  float fade = anim->fadeIn * alpha;
+
+  // Draw shadow for the entire card
+  Rectangle shadowRect = {mainCard.x + 4, mainCard.y + 6, mainCard.width, mainCard.height};
+  DrawRectangleRounded(shadowRect, 0.05f, 16, Fade(BLACK, 0.4f * alpha));
+  
+  // Draw weather banner with rounded top corners
+  if (data->weatherBanner.id != 0) {
+    Rectangle bannerRect = {mainCard.x, mainCard.y, mainCard.width, 200};
+    Rectangle srcRect = {0, 0, (float)data->weatherBanner.width, (float)data->weatherBanner.height};
+    
+    // Draw the banner image with rounded top corners - fades only during a city cross-fade
+    DrawTexturePro(data->weatherBanner, srcRect, bannerRect, (Vector2){0, 0}, 0, Fade(WHITE, alpha));
+    
+    // Light overlay for better text readability
+    DrawRectangleRounded(bannerRect, 0.05f, 16, Fade((Color){0, 0, 0, 60}, 0.8f * alpha));
+  }
+  
+  // Draw the bottom part of the card (below the banner)
+  Rectangle bottomCard = {mainCard.x, mainCard.y + 200, mainCard.width, mainCard.height - 200};
+  DrawRectangle(bottomCard.x, bottomCard.y, bottomCard.width, bottomCard.height, Fade(BG_CARD, alpha));
+  
+  // Draw rounded bottom corners
+  DrawRectangleRounded((Rectangle){mainCard.x, mainCard.y + mainCard.height - 20, mainCard.width, 20}, 0.5f, 16, Fade(BG_CARD, alpha));
+  
+  // Draw subtle border around entire card
+  DrawRectangleRoundedLines(mainCard, 0.05f, 16, Fade(WHITE, 0.1f * alpha));
+  
+  // City name and country
+  Vector2 cityPos = {mainCard.x + 30, mainCard.y + 30};
+  DrawTextEx(regularFont, textCache->location, 
+             cityPos, 32, 2, Fade(TEXT_PRIMARY, fade * anim->fieldFade[FIELD_LOCATION]));
+  
+  // Weather description
+  Vector2 descPos = {mainCard.x + 30, mainCard.y + 70};
+  DrawTextEx(regularFont, data->description, descPos, 20, 1, 
+             Fade(TEXT_SECONDARY, fade * anim->fieldFade[FIELD_DESCRIPTION]));
+  
+  // Temperature (large) - Draw with black rounded background
+  Vector2 tempSize = textCache->temperatureSize;
+  Vector2 tempPos = {mainCard.x + 30, mainCard.y + 110};
+  
+  // Draw black rounded background for temperature with no white corners
+  Rectangle tempBg = {
+    tempPos.x - 15, 
+    tempPos.y - 10, 
+    tempSize.x + 30, 
+    tempSize.y + 20
+  };
+  
+  // Draw filled rounded rectangle with higher segment count for smoother corners
+  DrawRectangleRounded(tempBg, 0.2f, 32, Fade(BLACK, fade * 0.8f));
+  
+  // Draw temperature text
+  DrawTextEx(customFont, data->temperature, tempPos, 96, 3, 
+             Fade(TEXT_PRIMARY, fade * anim->fieldFade[FIELD_TEMPERATURE]));
+  
+  // Weather icon with animation
+  if (data->weatherlogo.id != 0) {
+    float logoScale = 0.4f;
+    float logoX = mainCard.x + mainCard.width - 200;
+    float logoY = mainCard.y + 50 + anim->logoFloat;
+    
+    DrawTextureEx(data->weatherlogo, 
+                 (Vector2){logoX, logoY}, 
+                 anim->logoRotation, 
+                 logoScale, 
+                 Fade(WHITE, fade * anim->fieldFade[FIELD_ASSETS]));
+  }
+  
+  // Info cards section
+  float cardY = mainCard.y + 250;
+  float cardSpacing = 20;
+  float cardWidth = (mainCard.width - 90) / 3;
+  
+  // Feels like card
+  Rectangle feelsLikeCard = {mainCard.x + 30, cardY, cardWidth, 100};
+  DrawCard(feelsLikeCard, 0.08f, Fade(BG_CARD_HOVER, alpha), 0.2f * alpha);
+  DrawTextEx(regularFont, "FEELS LIKE", 
+             (Vector2){feelsLikeCard.x + 20, feelsLikeCard.y + 20}, 
+             14, 1, Fade(TEXT_SECONDARY, fade));
+  DrawTextEx(regularFont, textCache->feelsLike, 
+             (Vector2){feelsLikeCard.x + 20, feelsLikeCard.y + 50}, 
+             32, 2, Fade(TEXT_PRIMARY, fade * anim->fieldFade[FIELD_FEELS_LIKE]));
+  
+  // Humidity card
+  Rectangle humidityCard = {mainCard.x + 30 + cardWidth + cardSpacing, cardY, cardWidth, 100};
+  DrawCard(humidityCard, 0.08f, Fade(BG_CARD_HOVER, alpha), 0.2f * alpha);
+  DrawTextEx(regularFont, "HUMIDITY", 
+             (Vector2){humidityCard.x + 20, humidityCard.y + 20}, 
+             14, 1, Fade(TEXT_SECONDARY, fade));
+  DrawTextEx(regularFont, data->humidity, 
+             (Vector2){humidityCard.x + 20, humidityCard.y + 50}, 
+             32, 2, Fade(TEXT_PRIMARY, fade * anim->fieldFade[FIELD_HUMIDITY]));
+  
+  // Wind speed card
+  Rectangle windCard = {mainCard.x + 30 + (cardWidth + cardSpacing) * 2, cardY, cardWidth, 100};
+  DrawCard(windCard, 0.08f, Fade(BG_CARD_HOVER, alpha), 0.2f * alpha);
+  DrawTextEx(regularFont, "WIND SPEED", 
+             (Vector2){windCard.x + 20, windCard.y + 20}, 
+             14, 1, Fade(TEXT_SECONDARY, fade));
+  DrawTextEx(regularFont, textCache->windSpeed, 
+             (Vector2){windCard.x + 20, windCard.y + 50}, 
+             32, 2, Fade(TEXT_PRIMARY, fade * anim->fieldFade[FIELD_WIND_SPEED]));
+}
+
 int main(int argc, char *argv[])
 {
   setlocale(LC_ALL, "");
   const int winWidth = 800;
   const int winHeight = 500;
   const char *basePath = GetApplicationDirectory();
-  const char *fullPath_of_WeatherBanner = NULL;
-  const char *fullPath_of_WeatherLogo = NULL;
 
   // Get city from command-line argument or use default
   const char *city = "Lahore";  // Default city
-  if (argc > 1) {
+  bool rotationMode = false;
+  float rotationInterval = ROTATION_DEFAULT_INTERVAL;
+  char **rotationCities = NULL;
+  int rotationCityCount = 0;
+  
+  // Rotation mode: --rotate <seconds> <city> [city...]
+  bool usageError = false;
+  if (argc > 1 && strcmp(argv[1], "--rotate") == 0) {
+    char *intervalEnd = NULL;
+    if (argc >= 4) {
+      rotationInterval = strtof(argv[2], &intervalEnd);
+    }
+    if (argc < 4 || intervalEnd == argv[2] || *intervalEnd != '\0' || !(rotationInterval > 0)) {
+      usageError = true;
+      fprintf(stderr, "Usage: %s --rotate <seconds> <city> [city...]\n", argv[0]);
+    } else {
+      rotationMode = true;
+      rotationCities = &argv[3];
+      rotationCityCount = argc - 3;
+    }
+  } else if (argc > 1) {
     city = argv[1];
   }
 
   weatherData myData = {0};
   AppState appState = STATE_LOADING;
+  RotationPipeline rotation = {0};
+  bool rotationStarted = false;
   
   const char *API_KEY = getenv("OPENWEATHER_API_KEY");
-  if (!API_KEY || API_KEY[0] == '\0') {
+  if (usageError) {
+    API_KEY = NULL;
+    appState = STATE_ERROR_USAGE;
+    snprintf(myData.errorMessage, sizeof(myData.errorMessage), 
+             "Invalid Arguments\n--rotate needs <seconds> > 0 and a city");
+  } else if (!API_KEY || API_KEY[0] == '\0') {
+      API_KEY = NULL;
       appState = STATE_ERROR_API_KEY;
       snprintf(myData.errorMessage, sizeof(myData.errorMessage), 
                "Missing API Key\nSet OPENWEATHER_API_KEY environment variable");
       printf("Missing API KEY. Set OPENWEATHER_API_KEY\n");
+  } else if (curl_global_init(CURL_GLOBAL_ALL) != CURLE_OK) {
+    API_KEY = NULL;
+    appState = STATE_ERROR_NETWORK;
+    snprintf(myData.errorMessage, sizeof(myData.errorMessage), 
+             "Network Error\nFailed to initialize CURL");
+  } else if (rotationMode) {
+    // The card stays in the loading state until the first prefetched city is ready
+    snprintf(myData.errorMessage, sizeof(myData.errorMessage), 
+             "Fetching %d cities", rotationCityCount);
+    rotationStarted = startRotationPipeline(&rotation, rotationCities, rotationCityCount, API_KEY, basePath);
+    if (!rotationStarted) {
+      appState = STATE_ERROR_NETWORK;
+      snprintf(myData.errorMessage, sizeof(myData.errorMessage), 
+               "Rotation Error\nFailed to start prefetch worker");
+    }
   } else {
     // Fetch weather data on startup
-    appState = fetchWeatherData(city, API_KEY, &myData, &fullPath_of_WeatherBanner, &fullPath_of_WeatherLogo, basePath);
+    appState = fetchWeatherData(city, API_KEY, &myData, basePath);
   }
 
   SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_MSAA_4X_HINT);
@@ -375,28 +896,24 @@ int main(int argc, char *argv[])
   
   // Only load textures if we have successful data
   if (appState == STATE_SUCCESS) {
-    if(fullPath_of_WeatherBanner ==NULL){
-        fprintf(stderr, "Failed to load path for weather banner");
-    } else {
-      myData.weatherBanner = LoadTexture(fullPath_of_WeatherBanner);
-      if(myData.weatherBanner.id==0){
-          fprintf(stderr, "unable to load weather banner texture");
-      }
-    }
-
-    if(fullPath_of_WeatherLogo==NULL){
-        fprintf(stderr, "Failed to load path for weather logo");
-    } else {
-      myData.weatherlogo = LoadTexture(fullPath_of_WeatherLogo);
-      if(myData.weatherlogo.id==0){
-          fprintf(stderr, "unable to load weather logo texture");
-      }
-    }
+    myData.weatherBanner = updateWeatherTexture(myData.weatherBanner, "", myData.bannerPath, "banner");
+    myData.weatherlogo = updateWeatherTexture(myData.weatherlogo, "", myData.logoPath, "logo");
   }
   
   // Load fonts - using default font for better readability
   Font customFont = GetFontDefault();
   Font regularFont = GetFontDefault();
+
+  // Build the text cache for the initial data
+  TextCache textCache = {0};
+  updateTextCache(&textCache, &myData, ALL_FIELDS_CHANGED, customFont);
+  
+  // Rotation mode: outgoing card kept for the cross-fade, and textures shared by all cities
+  weatherData previousData = {0};
+  TextCache previousTextCache = {0};
+  TextureCache rotationTextures = {0};
+  double lastRotation = 0.0;
+  bool pendingAdvance = false;  // "Next" was clicked before the next city was ready
   
   // Initialize animation state
   AnimationState anim = {0};
@@ -404,6 +921,10 @@ int main(int argc, char *argv[])
   anim.cardScale = 0.8f;
   anim.buttonScale = 0.8f;
   anim.shimmerOffset = 0.0f;
+  for (int i = 0; i < FIELD_COUNT; i++) {
+    anim.fieldFade[i] = 1.0f;
+  }
+  anim.crossFade = 1.0f;
 
   // Create refresh button
   Button refreshButton = {0};
@@ -430,6 +951,10 @@ int main(int argc, char *argv[])
     anim.buttonScale = fminf(anim.buttonScale + 0.02f, 1.0f);
     anim.logoFloat = sinf(GetTime() * 2.0f) * 5.0f;
     anim.logoRotation = sinf(GetTime() * 0.5f) * 2.0f;
+    for (int i = 0; i < FIELD_COUNT; i++) {
+      anim.fieldFade[i] = fminf(anim.fieldFade[i] + 0.04f, 1.0f);
+    }
+    anim.crossFade = fminf(anim.crossFade + 0.03f, 1.0f);
     anim.shimmerOffset += 3.0f;
     if (anim.shimmerOffset > currentWidth + 100) anim.shimmerOffset = -100;
     
@@ -438,31 +963,83 @@ int main(int argc, char *argv[])
     refreshButton.isHovered = CheckCollisionPointRec(mousePos, refreshButton.bounds);
     refreshButton.isPressed = refreshButton.isHovered && IsMouseButtonDown(MOUSE_LEFT_BUTTON);
     
-    // Handle refresh button click
-    if (refreshButton.isHovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && API_KEY) {
-      // Unload old textures if they exist
-      if (appState == STATE_SUCCESS) {
-        if (myData.weatherBanner.id != 0) UnloadTexture(myData.weatherBanner);
-        if (myData.weatherlogo.id != 0) UnloadTexture(myData.weatherlogo);
+    bool buttonClicked = refreshButton.isHovered && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+    if (buttonClicked && rotationMode) pendingAdvance = true;
+    
+    // Advance the city rotation; all network, parsing and decoding happened on the worker
+    RotationSlot *nextSlot = rotationStarted ? peekRotationSlot(&rotation) : NULL;
+    if (nextSlot != NULL) {
+      if (nextSlot->bannerImage.data != NULL) {
+        // Upload at most one texture per frame, ahead of the transition
+        if (!uploadCachedTexture(&rotationTextures, nextSlot->data.bannerPath, &nextSlot->bannerImage)) {
+          forgetRotationAsset(&rotation, nextSlot->data.bannerPath);
+        }
+      } else if (nextSlot->logoImage.data != NULL) {
+        if (!uploadCachedTexture(&rotationTextures, nextSlot->data.logoPath, &nextSlot->logoImage)) {
+          forgetRotationAsset(&rotation, nextSlot->data.logoPath);
+        }
+      } else if (nextSlot->state != STATE_SUCCESS) {
+        // Skip cities that failed (the worker logs them), unless there is nothing else to show yet
+        if (appState != STATE_SUCCESS) {
+          appState = nextSlot->state;
+          snprintf(myData.errorMessage, sizeof(myData.errorMessage), "%s", nextSlot->data.errorMessage);
+        }
+        releaseRotationSlot(&rotation);
+      } else if (appState != STATE_SUCCESS || pendingAdvance ||
+                 GetTime() - lastRotation >= rotationInterval) {
+        // Pure in-memory swap: the previous card cross-fades out under the new one
+        if (appState == STATE_SUCCESS) {
+          previousData = myData;
+          previousTextCache = textCache;
+          anim.crossFade = 0.0f;
+        } else {
+          anim.fadeIn = 0.0f;
+          anim.cardScale = 0.8f;
+        }
+        myData = nextSlot->data;
+        myData.weatherBanner = findCachedTexture(&rotationTextures, myData.bannerPath);
+        myData.weatherlogo = findCachedTexture(&rotationTextures, myData.logoPath);
+        updateTextCache(&textCache, &myData, ALL_FIELDS_CHANGED, customFont);
+        appState = STATE_SUCCESS;
+        lastRotation = GetTime();
+        pendingAdvance = false;
+        releaseRotationSlot(&rotation);
       }
+    }
+    
+    // Handle refresh button click
+    if (buttonClicked && API_KEY && !rotationMode) {
+      // Fetch into a fresh record so it can be compared against the current one
+      weatherData newData = {0};
+      AppState newState = fetchWeatherData(city, API_KEY, &newData, basePath);
       
-      // Reset data and fetch new weather
-      memset(&myData, 0, sizeof(weatherData));
-      appState = fetchWeatherData(city, API_KEY, &myData, &fullPath_of_WeatherBanner, &fullPath_of_WeatherLogo, basePath);
-      
-      // Load new textures if successful
-      if (appState == STATE_SUCCESS) {
-        if (fullPath_of_WeatherBanner) {
-          myData.weatherBanner = LoadTexture(fullPath_of_WeatherBanner);
+      if (newState == STATE_SUCCESS) {
+        // Coming back from an error redraws everything, otherwise only what changed
+        unsigned int changed = ALL_FIELDS_CHANGED;
+        if (appState == STATE_SUCCESS) {
+          changed = diffWeatherData(&myData, &newData);
         }
-        if (fullPath_of_WeatherLogo) {
-          myData.weatherlogo = LoadTexture(fullPath_of_WeatherLogo);
+        
+        // Textures are kept whenever the asset mapping is unchanged
+        newData.weatherBanner = updateWeatherTexture(myData.weatherBanner, myData.bannerPath, newData.bannerPath, "banner");
+        newData.weatherlogo = updateWeatherTexture(myData.weatherlogo, myData.logoPath, newData.logoPath, "logo");
+        myData = newData;
+        updateTextCache(&textCache, &myData, changed, customFont);
+        
+        if (appState != STATE_SUCCESS) {
+          anim.fadeIn = 0.0f;
+          anim.cardScale = 0.8f;
+        } else {
+          // Animate only the changed values
+          for (int i = 0; i < FIELD_COUNT; i++) {
+            if (changed & FIELD_BIT(i)) anim.fieldFade[i] = 0.0f;
+          }
         }
+      } else {
+        // Keep the last good record (and its textures) around for the next refresh
+        snprintf(myData.errorMessage, sizeof(myData.errorMessage), "%s", newData.errorMessage);
       }
-      
-      // Reset animations
-      anim.fadeIn = 0.0f;
-      anim.cardScale = 0.8f;
+      appState = newState;
     }
 
     BeginDrawing();
@@ -487,108 +1064,11 @@ int main(int argc, char *argv[])
       mainCard.width *= anim.cardScale;
       mainCard.height *= anim.cardScale;
       
-      // Draw shadow for the entire card
-      Rectangle shadowRect = {mainCard.x + 4, mainCard.y + 6, mainCard.width, mainCard.height};
-      DrawRectangleRounded(shadowRect, 0.05f, 16, Fade(BLACK, 0.4f));
-      
-      // Draw weather banner with rounded top corners
-      if (myData.weatherBanner.id != 0) {
-        Rectangle bannerRect = {mainCard.x, mainCard.y, mainCard.width, 200};
-        Rectangle srcRect = {0, 0, (float)myData.weatherBanner.width, (float)myData.weatherBanner.height};
-        
-        // Draw the banner image with rounded top corners - no fade animation
-        DrawTexturePro(myData.weatherBanner, srcRect, bannerRect, (Vector2){0, 0}, 0, WHITE);
-        
-        // Light overlay for better text readability
-        DrawRectangleRounded(bannerRect, 0.05f, 16, Fade((Color){0, 0, 0, 60}, 0.8f));
+      // Outgoing and incoming cards fade in opposite directions so both finish together
+      if (anim.crossFade < 1.0f) {
+        DrawWeatherCard(&previousData, &previousTextCache, mainCard, customFont, regularFont, &anim, 1.0f - anim.crossFade);
       }
-      
-      // Draw the bottom part of the card (below the banner)
-      Rectangle bottomCard = {mainCard.x, mainCard.y + 200, mainCard.width, mainCard.height - 200};
-      DrawRectangle(bottomCard.x, bottomCard.y, bottomCard.width, bottomCard.height, BG_CARD);
-      
-      // Draw rounded bottom corners
-      DrawRectangleRounded((Rectangle){mainCard.x, mainCard.y + mainCard.height - 20, mainCard.width, 20}, 0.5f, 16, BG_CARD);
-      
-      // Draw subtle border around entire card
-      DrawRectangleRoundedLines(mainCard, 0.05f, 16, Fade(WHITE, 0.1f));
-      
-      // City name and country
-      Vector2 cityPos = {mainCard.x + 30, mainCard.y + 30};
-      DrawTextEx(regularFont, TextFormat("%s, %s", myData.city, myData.country), 
-                 cityPos, 32, 2, Fade(TEXT_PRIMARY, anim.fadeIn));
-      
-      // Weather description
-      Vector2 descPos = {mainCard.x + 30, mainCard.y + 70};
-      DrawTextEx(regularFont, myData.description, descPos, 20, 1, Fade(TEXT_SECONDARY, anim.fadeIn));
-      
-      // Temperature (large) - Draw with black rounded background
-      char tempStr[64];
-      snprintf(tempStr, sizeof(tempStr), "%s", myData.temperature);
-      Vector2 tempSize = MeasureTextEx(customFont, tempStr, 96, 3);
-      Vector2 tempPos = {mainCard.x + 30, mainCard.y + 110};
-      
-      // Draw black rounded background for temperature with no white corners
-      Rectangle tempBg = {
-        tempPos.x - 15, 
-        tempPos.y - 10, 
-        tempSize.x + 30, 
-        tempSize.y + 20
-      };
-      
-      // Draw filled rounded rectangle with higher segment count for smoother corners
-      DrawRectangleRounded(tempBg, 0.2f, 32, Fade(BLACK, anim.fadeIn * 0.8f));
-      
-      // Draw temperature text
-      DrawTextEx(customFont, tempStr, tempPos, 96, 3, Fade(TEXT_PRIMARY, anim.fadeIn));
-      
-      // Weather icon with animation
-      if (myData.weatherlogo.id != 0) {
-        float logoScale = 0.4f;
-        float logoX = mainCard.x + mainCard.width - 200;
-        float logoY = mainCard.y + 50 + anim.logoFloat;
-        
-        DrawTextureEx(myData.weatherlogo, 
-                     (Vector2){logoX, logoY}, 
-                     anim.logoRotation, 
-                     logoScale, 
-                     Fade(WHITE, anim.fadeIn));
-      }
-      
-      // Info cards section
-      float cardY = mainCard.y + 250;
-      float cardSpacing = 20;
-      float cardWidth = (mainCard.width - 90) / 3;
-      
-      // Feels like card
-      Rectangle feelsLikeCard = {mainCard.x + 30, cardY, cardWidth, 100};
-      DrawCard(feelsLikeCard, 0.08f, BG_CARD_HOVER, 0.2f);
-      DrawTextEx(regularFont, "FEELS LIKE", 
-                 (Vector2){feelsLikeCard.x + 20, feelsLikeCard.y + 20}, 
-                 14, 1, Fade(TEXT_SECONDARY, anim.fadeIn));
-      DrawTextEx(regularFont, TextFormat("%d°C", myData.feelsLike), 
-                 (Vector2){feelsLikeCard.x + 20, feelsLikeCard.y + 50}, 
-                 32, 2, Fade(TEXT_PRIMARY, anim.fadeIn));
-      
-      // Humidity card
-      Rectangle humidityCard = {mainCard.x + 30 + cardWidth + cardSpacing, cardY, cardWidth, 100};
-      DrawCard(humidityCard, 0.08f, BG_CARD_HOVER, 0.2f);
-      DrawTextEx(regularFont, "HUMIDITY", 
-                 (Vector2){humidityCard.x + 20, humidityCard.y + 20}, 
-                 14, 1, Fade(TEXT_SECONDARY, anim.fadeIn));
-      DrawTextEx(regularFont, myData.humidity, 
-                 (Vector2){humidityCard.x + 20, humidityCard.y + 50}, 
-                 32, 2, Fade(TEXT_PRIMARY, anim.fadeIn));
-      
-      // Wind speed card
-      Rectangle windCard = {mainCard.x + 30 + (cardWidth + cardSpacing) * 2, cardY, cardWidth, 100};
-      DrawCard(windCard, 0.08f, BG_CARD_HOVER, 0.2f);
-      DrawTextEx(regularFont, "WIND SPEED", 
-                 (Vector2){windCard.x + 20, windCard.y + 20}, 
-                 14, 1, Fade(TEXT_SECONDARY, anim.fadeIn));
-      DrawTextEx(regularFont, TextFormat("%d km/h", myData.windSpeed), 
-                 (Vector2){windCard.x + 20, windCard.y + 50}, 
-                 32, 2, Fade(TEXT_PRIMARY, anim.fadeIn));
+      DrawWeatherCard(&myData, &textCache, mainCard, customFont, regularFont, &anim, anim.crossFade);
       
     } else {
       // Error state - centered card
@@ -627,6 +1107,10 @@ int main(int argc, char *argv[])
           errorTitle = "Data Error";
           errorIcon = "⚠";
           break;
+        case STATE_ERROR_USAGE:
+          errorTitle = "Usage Error";
+          errorIcon = "?";
+          break;
         default:
           errorTitle = "Unknown Error";
       }
@@ -649,7 +1133,7 @@ int main(int argc, char *argv[])
                  18, 1, TEXT_SECONDARY);
       
       // Draw usage hint
-      const char *hint = "Usage: ./weather_app [city_name]";
+      const char *hint = "Usage: ./weather_app [city] | --rotate <sec> <cities>";
       Vector2 hintSize = MeasureTextEx(regularFont, hint, 14, 1);
       DrawTextEx(regularFont, hint, 
                  (Vector2){errorCard.x + (errorCard.width - hintSize.x) / 2, errorCard.y + 240}, 
@@ -657,7 +1141,7 @@ int main(int argc, char *argv[])
     }
     
     // Draw refresh button with enhanced styling
-    DrawEnhancedButton(&refreshButton, "Refresh", regularFont, 18, &anim);
+    DrawEnhancedButton(&refreshButton, rotationMode ? "Next" : "Refresh", regularFont, 18, &anim);
     
     // Draw app title in bottom left
     DrawTextEx(regularFont, "Weather App", 
@@ -668,9 +1152,20 @@ int main(int argc, char *argv[])
   }
 
   // Cleanup
-  if (myData.weatherBanner.id != 0) UnloadTexture(myData.weatherBanner);
-  if (myData.weatherlogo.id != 0) UnloadTexture(myData.weatherlogo);
+  if (rotationMode) {
+    // Rotation cards only borrow textures from the shared cache
+    for (int i = 0; i < rotationTextures.count; i++) {
+      if (rotationTextures.textures[i].id != 0) UnloadTexture(rotationTextures.textures[i]);
+    }
+  } else {
+    if (myData.weatherBanner.id != 0) UnloadTexture(myData.weatherBanner);
+    if (myData.weatherlogo.id != 0) UnloadTexture(myData.weatherlogo);
+  }
   CloseWindow();
 
+  // Join the worker only after the window is gone so a pending download can't freeze it
+  if (rotationStarted) stopRotationPipeline(&rotation);
+  if (API_KEY) curl_global_cleanup();
+
   return 0;
 }